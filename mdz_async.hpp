@@ -0,0 +1,217 @@
+/**
+ * \ingroup mdz_unicode library
+ *
+ * \author maxdz Software GmbH
+ *
+ * \par license
+ * This file is subject to the terms and conditions defined in file 'LICENSE.txt', which is part of this source code package.
+ *
+ * \par description
+ * C++20 coroutine layer for asynchronous "_async" functions of mdz_unicode library.
+ *
+ * mdz::asyncCall() returns awaitable, which starts asynchronous call when awaited and suspends coroutine until the call is finished.
+ * Coroutine is resumed using user-supplied executor: any callable object, which accepts std::coroutine_handle<> and arranges its resume() call
+ * (for example posts it to the queue of event loop).
+ *
+ * Each started call is waited on its own thread, which joins thread of the call and then invokes executor. Thus coroutine is resumed as soon as its own call is finished,
+ * independently of other calls, and executor is invoked from that waiting thread. The waiting thread uses only copies of executor and coroutine handle,
+ * because awaitable may be destroyed right after executor is invoked.
+ * Stop request on std::stop_token passed to mdz::asyncCall() sets m_bCancel of mdz_asyncData in mdz_true and is reported in m_bCancelled of mdz::AsyncResult.
+ * If stop is already requested when awaitable is awaited, "_async" function is not called at all and coroutine is not suspended.
+ *
+ * Example:
+ *
+ * mdz::AsyncResult result = co_await mdz::asyncCall(executor, [&](mdz_asyncData* pAsyncData)
+ * {
+ *   return mdz_utf8_insertUtf16_async(pUtf8, (size_t)-1, pItems, nCount, MDZ_ENDIAN_LITTLE, mdz_true, pAsyncData);
+ * }, stopToken);
+ *
+ * \par portability
+ * Requires C++20 compiler (coroutines and std::stop_token).
+ *
+ * \par info
+ * See additional info on mdz_unicode library like version, portability, etc in mdz_unicode.h
+ */
+
+#ifndef MDZ_UNICODE_ASYNC_HPP
+#define MDZ_UNICODE_ASYNC_HPP
+
+#include "mdz_types.h"
+
+#include <coroutine>
+#include <optional>
+#include <stop_token>
+#include <thread>
+#include <utility>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+namespace mdz
+{
+
+/**
+ * Result of awaited asynchronous call
+ */
+struct AsyncResult
+{
+  /**
+   * mdz_true if asynchronous call was started in new thread. Otherwise mdz_false: call returned mdz_false, or returned mdz_true without starting thread
+   * (for example nothing to insert, or thread allocation failed). Error code is in container m_enErrorCode
+   */
+  mdz_bool m_bStarted;
+
+  /**
+   * mdz_true if the call is completely finished. Otherwise mdz_false (if not started or cancelled)
+   */
+  mdz_bool m_bFinished;
+
+  /**
+   * mdz_true if stop was requested on std::stop_token before the call was started (then "_async" function was not called and container is not changed),
+   * or while it was executed. Otherwise mdz_false. The call may still be completely finished, if stop was requested too late to interrupt it
+   */
+  mdz_bool m_bCancelled;
+
+  /**
+   * Result of call. Invalid if m_bFinished is mdz_false
+   */
+  size_t m_nResult;
+
+  /**
+   * Additional data returned by call (if any). Invalid if m_bFinished is mdz_false
+   */
+  void* m_pData;
+};
+
+/**
+ * Executor which resumes coroutine immediately, on the thread where the call is finished
+ */
+struct InlineExecutor
+{
+  void operator()(std::coroutine_handle<> hCoroutine) const
+  {
+    hCoroutine.resume();
+  }
+};
+
+/**
+ * Awaitable of asynchronous call. Created using mdz::asyncCall()
+ */
+template <class Executor, class Call>
+class AsyncAwaitable
+{
+public:
+  AsyncAwaitable(Executor executor, Call call, std::stop_token stopToken)
+    : m_executor(std::move(executor)), m_call(std::move(call)), m_stopToken(std::move(stopToken)), m_asyncData(), m_bStarted(mdz_false), m_bStoppedBeforeStart(mdz_false)
+  {
+  }
+
+  AsyncAwaitable(const AsyncAwaitable&) = delete;
+  AsyncAwaitable& operator=(const AsyncAwaitable&) = delete;
+
+  bool await_ready() const noexcept
+  {
+    return false;
+  }
+
+  bool await_suspend(std::coroutine_handle<> hCoroutine)
+  {
+    if (m_stopToken.stop_requested())
+    {
+      m_bStoppedBeforeStart = mdz_true;
+      return false;
+    }
+
+    /* "_async" functions return mdz_true also if there is nothing to do (e.g. MDZ_ERROR_ZEROCOUNT) or thread allocation failed (MDZ_ERROR_THREAD_ALLOC),
+       without starting thread. m_hThread is set only if thread is started, and m_enErrorCode of container cannot be used instead: started thread also sets it */
+    m_bStarted = ((m_call(&m_asyncData) && m_asyncData.m_hThread != ThreadHandle()) ? mdz_true : mdz_false);
+    if (!m_bStarted)
+    {
+      return false;
+    }
+
+    /* "_async" function clears m_bCancel before starting thread, thus stop callback is registered only after the call is started.
+       If stop was requested in the meantime, callback is invoked immediately */
+    m_stopCallback.emplace(m_stopToken, CancelRequest{ &m_asyncData });
+
+    /* "this" may be destroyed right after executor is invoked, thus only copies are used in waiting thread */
+    std::thread([hThread = m_asyncData.m_hThread, executor = m_executor, hCoroutine]() mutable
+    {
+      waitThread(hThread);
+      executor(hCoroutine);
+    }).detach();
+
+    return true;
+  }
+
+  AsyncResult await_resume()
+  {
+    /* also waits for CancelRequest, if it is being executed on other thread */
+    m_stopCallback.reset();
+
+    AsyncResult result;
+    result.m_bStarted = m_bStarted;
+    result.m_bFinished = (m_bStarted ? m_asyncData.m_bFinished : mdz_false);
+    result.m_bCancelled = ((m_bStoppedBeforeStart || (m_bStarted && m_asyncData.m_bCancel)) ? mdz_true : mdz_false);
+    result.m_nResult = m_asyncData.m_nResult;
+    result.m_pData = m_asyncData.m_pData;
+    return result;
+  }
+
+private:
+#ifdef _WIN32
+  typedef HANDLE ThreadHandle;
+#else
+  typedef pthread_t ThreadHandle;
+#endif
+
+  struct CancelRequest
+  {
+    mdz_asyncData* m_pAsyncData;
+
+    void operator()() const noexcept
+    {
+      m_pAsyncData->m_bCancel = mdz_true;
+    }
+  };
+
+#ifdef _WIN32
+  static void waitThread(HANDLE hThread)
+  {
+    WaitForSingleObject(hThread, INFINITE);
+    CloseHandle(hThread);
+  }
+#else
+  static void waitThread(pthread_t hThread)
+  {
+    pthread_join(hThread, NULL);
+  }
+#endif
+
+  Executor m_executor;
+  Call m_call;
+  std::stop_token m_stopToken;
+  mdz_asyncData m_asyncData;
+  mdz_bool m_bStarted;
+  mdz_bool m_bStoppedBeforeStart;
+  std::optional<std::stop_callback<CancelRequest>> m_stopCallback;
+};
+
+/**
+ * Return awaitable of asynchronous call.
+ * \param executor - callable object accepting std::coroutine_handle<>, which arranges resume of coroutine after the call is finished
+ * \param call - callable object accepting mdz_asyncData*, which calls "_async" function with it and returns its result
+ * \param stopToken - stop token, stop request on which sets m_bCancel of the call in mdz_true. May be omitted if cancellation is not needed
+ * \return:
+ * Awaitable, which returns mdz::AsyncResult after co_await
+ */
+template <class Executor, class Call>
+AsyncAwaitable<Executor, Call> asyncCall(Executor executor, Call call, std::stop_token stopToken = std::stop_token())
+{
+  return AsyncAwaitable<Executor, Call>(std::move(executor), std::move(call), std::move(stopToken));
+}
+
+}
+
+#endif
@@ -32,6 +32,35 @@
 #define mdz_true 1
 typedef unsigned char mdz_bool;
 
+/**
+ * Storage class of functions defined in headers of mdz_containers library. Such functions do not need linking with library binaries.
+ */
+#if defined(__cplusplus) || (defined(__STDC_VERSION__) && __STDC_VERSION__ >= 199901L)
+#define MDZ_INLINE static inline
+#elif defined(_MSC_VER)
+#define MDZ_INLINE static __inline
+#elif defined(__GNUC__)
+#define MDZ_INLINE static __inline__
+#else
+#define MDZ_INLINE static
+#endif
+
+/**
+ * Return 2-byte value with swapped byte order.
+ */
+MDZ_INLINE uint16_t mdz_swap16(uint16_t nValue)
+{
+  return (uint16_t)((nValue >> 8) | (nValue << 8));
+}
+
+/**
+ * Return 4-byte value with swapped byte order.
+ */
+MDZ_INLINE uint32_t mdz_swap32(uint32_t nValue)
+{
+  return (nValue >> 24) | ((nValue >> 8) & 0x0000FF00) | ((nValue << 8) & 0x00FF0000) | (nValue << 24);
+}
+
 #ifdef _WIN32
 typedef void* HANDLE;
 #endif
@@ -123,6 +152,15 @@ enum mdz_endianness
   MDZ_ENDIAN_ERROR = 3
 };
 
+/**
+ * Return endianness of platform: MDZ_ENDIAN_LITTLE or MDZ_ENDIAN_BIG.
+ */
+MDZ_INLINE enum mdz_endianness mdz_hostEndianness(void)
+{
+  const uint16_t nTest = 1;
+  return (*(const unsigned char*)&nTest == 1 ? MDZ_ENDIAN_LITTLE : MDZ_ENDIAN_BIG);
+}
+
 /**
  * Result of comparison
  */
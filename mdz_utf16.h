@@ -196,6 +196,60 @@ mdz_bool mdz_utf16_isAttachedData(const struct mdz_Utf16* pUtf16);
  */
 size_t mdz_utf16_embedSize(const struct mdz_Utf16* pUtf16);
 
+/**
+ * \defgroup Access functions
+ * Access functions are defined in this header and read m_pData directly.
+ */
+
+/**
+ * Return symbol at position nPos as Unicode code point. "surrogate pairs" count as 1 symbol and are returned as one code point. Code point is returned in endianness of platform, independently of string endianness.
+ * Complexity is O(1) if string contains no "surrogate pairs" (Size == Length), otherwise O(n).
+ * \param pUtf16 - pointer to string returned by mdz_utf16_create() or mdz_utf16_create_attached()
+ * \param nPos - 0-based position in symbols
+ * \return:
+ * UINT32_MAX - if pUtf16 == NULL, or nPos >= Length
+ * Result     - Unicode code point of symbol
+ */
+MDZ_INLINE uint32_t mdz_utf16_get(const struct mdz_Utf16* pUtf16, size_t nPos)
+{
+  mdz_bool bSwap;
+  size_t nSize;
+  size_t i;
+  uint16_t nHigh;
+  uint16_t nLow;
+
+  if (pUtf16 == NULL || nPos >= mdz_utf16_length(pUtf16))
+  {
+    return UINT32_MAX;
+  }
+
+  nSize = mdz_utf16_size(pUtf16);
+  bSwap = (mdz_utf16_endianness(pUtf16) != mdz_hostEndianness());
+
+  if (nSize == mdz_utf16_length(pUtf16))
+  {
+    i = nPos;
+  }
+  else
+  {
+    for (i = 0; nPos > 0; nPos--)
+    {
+      nHigh = (bSwap ? mdz_swap16(pUtf16->m_pData[i]) : pUtf16->m_pData[i]);
+      i += ((nHigh & 0xFC00) == 0xD800 ? 2 : 1);
+    }
+  }
+
+  nHigh = (bSwap ? mdz_swap16(pUtf16->m_pData[i]) : pUtf16->m_pData[i]);
+
+  if ((nHigh & 0xFC00) == 0xD800 && i + 1 < nSize)
+  {
+    nLow = (bSwap ? mdz_swap16(pUtf16->m_pData[i + 1]) : pUtf16->m_pData[i + 1]);
+    return 0x10000 + ((uint32_t)(nHigh & 0x03FF) << 10) + (uint32_t)(nLow & 0x03FF);
+  }
+
+  return nHigh;
+}
+
 /**
  * \defgroup Insert/remove functions
  */
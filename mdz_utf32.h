@@ -192,6 +192,87 @@ mdz_bool mdz_utf32_isAttachedData(const struct mdz_Utf32* pUtf32);
  */
 size_t mdz_utf32_embedSize(const struct mdz_Utf32* pUtf32);
 
+/**
+ * \defgroup Access functions
+ * Access functions are defined in this header and read m_pData directly. Complexity of access to one symbol is O(1).
+ * There are deliberately no functions for changing symbols in place (like "set" or "scatter"): data of string should be changed only by library functions, not through m_pData.
+ */
+
+/**
+ * Return symbol at position nPos. Symbol is returned in endianness of platform, independently of string endianness.
+ * \param pUtf32 - pointer to string returned by mdz_utf32_create() or mdz_utf32_create_attached()
+ * \param nPos - 0-based position of symbol
+ * \return:
+ * UINT32_MAX - if pUtf32 == NULL, or nPos >= Size
+ * Result     - Unicode code point of symbol
+ */
+MDZ_INLINE uint32_t mdz_utf32_get(const struct mdz_Utf32* pUtf32, size_t nPos)
+{
+  uint32_t nSymbol;
+
+  if (pUtf32 == NULL || nPos >= mdz_utf32_size(pUtf32))
+  {
+    return UINT32_MAX;
+  }
+
+  nSymbol = pUtf32->m_pData[nPos];
+
+  if (mdz_utf32_endianness(pUtf32) != mdz_hostEndianness())
+  {
+    nSymbol = mdz_swap32(nSymbol);
+  }
+
+  return nSymbol;
+}
+
+/**
+ * Copy nCount symbols at positions pPositions into pOut. Symbols are returned in endianness of platform, independently of string endianness.
+ * \param pUtf32 - pointer to string returned by mdz_utf32_create() or mdz_utf32_create_attached()
+ * \param pPositions - 0-based positions of symbols, in any order. Positions may repeat
+ * \param nCount - count of positions in pPositions and of symbols in pOut
+ * \param pOut - pointer to returned symbols. pOut[i] is symbol at position pPositions[i]
+ * \return:
+ * mdz_false - if pUtf32 == NULL
+ * mdz_false - if pPositions == NULL or pOut == NULL
+ * mdz_false - if any of pPositions >= Size. Symbols before it are copied, the rest of pOut is not changed
+ * mdz_true  - if nCount == 0. Nothing is copied
+ * mdz_true  - symbols are copied
+ */
+MDZ_INLINE mdz_bool mdz_utf32_gather(const struct mdz_Utf32* pUtf32, const size_t* pPositions, size_t nCount, uint32_t* pOut)
+{
+  mdz_bool bSwap;
+  size_t nSize;
+  size_t i;
+  uint32_t nSymbol;
+
+  if (pUtf32 == NULL || pPositions == NULL || pOut == NULL)
+  {
+    return mdz_false;
+  }
+
+  nSize = mdz_utf32_size(pUtf32);
+  bSwap = (mdz_utf32_endianness(pUtf32) != mdz_hostEndianness());
+
+  for (i = 0; i < nCount; i++)
+  {
+    if (pPositions[i] >= nSize)
+    {
+      return mdz_false;
+    }
+
+    nSymbol = pUtf32->m_pData[pPositions[i]];
+
+    if (bSwap)
+    {
+      nSymbol = mdz_swap32(nSymbol);
+    }
+
+    pOut[i] = nSymbol;
+  }
+
+  return mdz_true;
+}
+
 /**
  * \defgroup Insert/remove functions
  */
@@ -190,6 +190,59 @@ mdz_bool mdz_wchar_isAttachedData(const struct mdz_Wchar* pWchar);
  */
 size_t mdz_wchar_embedSize(const struct mdz_Wchar* pWchar);
 
+/**
+ * \defgroup Access functions
+ * Access functions are defined in this header and read m_pData directly.
+ */
+
+/**
+ * Return symbol at position nPos as Unicode code point. "surrogate pairs" count as 1 symbol and are returned as one code point.
+ * Complexity is O(1) if sizeof(wchar_t) is 4 bytes or string contains no "surrogate pairs" (Size == Length), otherwise O(n).
+ * \param pWchar - pointer to string returned by mdz_wchar_create() or mdz_wchar_create_attached()
+ * \param nPos - 0-based position in symbols
+ * \return:
+ * UINT32_MAX - if pWchar == NULL, or nPos >= Length
+ * Result     - Unicode code point of symbol
+ */
+MDZ_INLINE uint32_t mdz_wchar_get(const struct mdz_Wchar* pWchar, size_t nPos)
+{
+  const uint16_t* pData16;
+  size_t nSize;
+  size_t i;
+
+  if (pWchar == NULL || nPos >= mdz_wchar_length(pWchar))
+  {
+    return UINT32_MAX;
+  }
+
+  if (mdz_wchar_sizeof(pWchar) == 4)
+  {
+    return ((const uint32_t*)(const void*)pWchar->m_pData)[nPos];
+  }
+
+  pData16 = (const uint16_t*)(const void*)pWchar->m_pData;
+  nSize = mdz_wchar_size(pWchar);
+
+  if (nSize == mdz_wchar_length(pWchar))
+  {
+    i = nPos;
+  }
+  else
+  {
+    for (i = 0; nPos > 0; nPos--)
+    {
+      i += ((pData16[i] & 0xFC00) == 0xD800 ? 2 : 1);
+    }
+  }
+
+  if ((pData16[i] & 0xFC00) == 0xD800 && i + 1 < nSize)
+  {
+    return 0x10000 + ((uint32_t)(pData16[i] & 0x03FF) << 10) + (uint32_t)(pData16[i + 1] & 0x03FF);
+  }
+
+  return pData16[i];
+}
+
 /**
  * \defgroup Insert/remove functions
  */